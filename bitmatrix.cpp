@@ -0,0 +1,345 @@
+#include "bitmatrix.h"
+#include <algorithm>
+#include <bitset>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Maska k najmłodszych bitów słowa (0 <= k <= 64).
+ */
+std::uint64_t maska_niskich(int k) {
+    return k >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << k) - 1;
+}
+
+/**
+ * @brief Indeks najmłodszego ustawionego bitu (x != 0).
+ */
+int najnizszy_bit(unsigned x) {
+    int i = 0;
+    while (!(x & 1u)) {
+        x >>= 1;
+        i++;
+    }
+    return i;
+}
+
+} // namespace
+
+// Konstruktor domyślny
+/**
+ * @brief Konstruktor domyślny klasy bitmatrix.
+ * Inicjalizuje macierz o rozmiarze 0.
+ */
+bitmatrix::bitmatrix() : size(0), slowa(0) {}
+
+// Konstruktor z wymiarem
+/**
+ * @brief Konstruktor tworzący wyzerowaną macierz o rozmiarze n x n.
+ *
+ * @param n Rozmiar macierzy (n x n)
+ */
+bitmatrix::bitmatrix(int n) : size(0), slowa(0) {
+    alokuj(n);
+}
+
+// Konstruktor z macierzy całkowitej
+/**
+ * @brief Konstruktor tworzący macierz logiczną z macierzy całkowitej.
+ * Elementy niezerowe stają się jedynkami.
+ *
+ * @param m Macierz źródłowa
+ */
+bitmatrix::bitmatrix(const matrix& m) : size(0), slowa(0) {
+    alokuj(m.rozmiar());
+    for (int i = 0; i < size; i++) {
+        std::uint64_t* w = wiersz(i);
+        for (int j = 0; j < size; j++) {
+            if (m.pokaz(i, j) != 0) w[j >> 6] |= std::uint64_t(1) << (j & 63);
+        }
+    }
+}
+
+std::uint64_t* bitmatrix::wiersz(int i) {
+    return data.data() + static_cast<std::size_t>(i) * slowa;
+}
+
+const std::uint64_t* bitmatrix::wiersz(int i) const {
+    return data.data() + static_cast<std::size_t>(i) * slowa;
+}
+
+/**
+ * @brief Zeruje bity wykraczające poza rozmiar macierzy w ostatnim słowie wiersza.
+ */
+void bitmatrix::przytnij() {
+    if (size % 64 == 0) return;
+    const std::uint64_t maska = maska_niskich(size % 64);
+    for (int i = 0; i < size; i++) {
+        wiersz(i)[slowa - 1] &= maska;
+    }
+}
+
+// Metody klasowe
+
+/**
+ * @brief Alokuje wyzerowaną macierz o rozmiarze n x n.
+ *
+ * @param n Rozmiar nowej macierzy
+ * @return bitmatrix& Odwołanie do obecnego obiektu macierzy
+ */
+bitmatrix& bitmatrix::alokuj(int n) {
+    size = n;
+    slowa = (n + 63) / 64;
+    data.assign(static_cast<std::size_t>(n) * slowa, 0);
+    return *this;
+}
+
+/**
+ * @brief Ustawia wartość w komórce macierzy.
+ *
+ * @param x Indeks wiersza
+ * @param y Indeks kolumny
+ * @param wartosc Wartość do ustawienia w komórce
+ * @return bitmatrix& Odwołanie do obecnego obiektu macierzy
+ */
+bitmatrix& bitmatrix::wstaw(int x, int y, bool wartosc) {
+    if (x < size && y < size) {
+        const std::uint64_t bit = std::uint64_t(1) << (y & 63);
+        std::uint64_t& slowo = wiersz(x)[y >> 6];
+        slowo = wartosc ? (slowo | bit) : (slowo & ~bit);
+    }
+    return *this;
+}
+
+/**
+ * @brief Zwraca wartość z komórki macierzy.
+ *
+ * @param x Indeks wiersza
+ * @param y Indeks kolumny
+ * @return bool Wartość przechowywana w danej komórce
+ * @throws std::out_of_range Jeśli indeksy są poza zakresem
+ */
+bool bitmatrix::pokaz(int x, int y) const {
+    if (x < size && y < size) {
+        return (wiersz(x)[y >> 6] >> (y & 63)) & 1;
+    }
+    throw std::out_of_range("Index out of range");
+}
+
+/**
+ * @brief Zwraca rozmiar macierzy.
+ *
+ * @return int Liczba wierszy (i kolumn) macierzy
+ */
+int bitmatrix::rozmiar() const {
+    return size;
+}
+
+/**
+ * @brief Zlicza jedynki w macierzy instrukcją popcount na całych słowach.
+ *
+ * @return long long Liczba jedynek
+ */
+long long bitmatrix::liczba_jedynek() const {
+    long long suma = 0;
+    for (std::uint64_t slowo : data) {
+        suma += static_cast<long long>(std::bitset<64>(slowo).count());
+    }
+    return suma;
+}
+
+/**
+ * @brief Zamienia macierz na macierz całkowitą 0/1.
+ *
+ * @return matrix Nowa macierz całkowita
+ */
+matrix bitmatrix::do_macierzy() const {
+    matrix m(size);
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            if (pokaz(i, j)) m.wstaw(i, j, 1);
+        }
+    }
+    return m;
+}
+
+/**
+ * @brief Tworzy macierz jednostkową (1 na przekątnej, 0 w pozostałych miejscach).
+ *
+ * @return bitmatrix& Odwołanie do obecnego obiektu macierzy
+ */
+bitmatrix& bitmatrix::przekatna() {
+    std::fill(data.begin(), data.end(), 0);
+    for (int i = 0; i < size; i++) {
+        wiersz(i)[i >> 6] = std::uint64_t(1) << (i & 63);
+    }
+    return *this;
+}
+
+/**
+ * @brief Tworzy macierz z 1 poniżej przekątnej (pozostałe miejsca to 0).
+ *
+ * @return bitmatrix& Odwołanie do obecnego obiektu macierzy
+ */
+bitmatrix& bitmatrix::pod_przekatna() {
+    for (int i = 0; i < size; i++) {
+        std::uint64_t* w = wiersz(i);
+        for (int k = 0; k < slowa; k++) {
+            w[k] = maska_niskich(std::max(0, std::min(64, i - 64 * k))); // Kolumny j < i
+        }
+    }
+    return *this;
+}
+
+/**
+ * @brief Tworzy macierz z 1 powyżej przekątnej (pozostałe miejsca to 0).
+ *
+ * @return bitmatrix& Odwołanie do obecnego obiektu macierzy
+ */
+bitmatrix& bitmatrix::nad_przekatna() {
+    for (int i = 0; i < size; i++) {
+        std::uint64_t* w = wiersz(i);
+        for (int k = 0; k < slowa; k++) {
+            w[k] = ~maska_niskich(std::max(0, std::min(64, i + 1 - 64 * k))); // Kolumny j > i
+        }
+    }
+    przytnij();
+    return *this;
+}
+
+/**
+ * @brief Tworzy macierz szachownicy (przeplatane 0 i 1).
+ *
+ * @return bitmatrix& Odwołanie do obecnego obiektu macierzy
+ */
+bitmatrix& bitmatrix::szachownica() {
+    const std::uint64_t nieparzyste = 0xAAAAAAAAAAAAAAAAull; // Bity o nieparzystym indeksie
+    for (int i = 0; i < size; i++) {
+        std::fill(wiersz(i), wiersz(i) + slowa, (i % 2) ? ~nieparzyste : nieparzyste);
+    }
+    przytnij();
+    return *this;
+}
+
+/**
+ * @brief Operator &= (AND element po elemencie, na całych słowach).
+ *
+ * @param m Druga macierz
+ * @return bitmatrix& Odwołanie do obecnego obiektu macierzy
+ */
+bitmatrix& bitmatrix::operator&=(const bitmatrix& m) {
+    if (size != m.size) throw std::invalid_argument("Matrix sizes must be the same");
+    for (std::size_t k = 0; k < data.size(); k++) data[k] &= m.data[k];
+    return *this;
+}
+
+/**
+ * @brief Operator |= (OR element po elemencie, na całych słowach).
+ *
+ * @param m Druga macierz
+ * @return bitmatrix& Odwołanie do obecnego obiektu macierzy
+ */
+bitmatrix& bitmatrix::operator|=(const bitmatrix& m) {
+    if (size != m.size) throw std::invalid_argument("Matrix sizes must be the same");
+    for (std::size_t k = 0; k < data.size(); k++) data[k] |= m.data[k];
+    return *this;
+}
+
+/**
+ * @brief Operator ^= (XOR element po elemencie, na całych słowach).
+ *
+ * @param m Druga macierz
+ * @return bitmatrix& Odwołanie do obecnego obiektu macierzy
+ */
+bitmatrix& bitmatrix::operator^=(const bitmatrix& m) {
+    if (size != m.size) throw std::invalid_argument("Matrix sizes must be the same");
+    for (std::size_t k = 0; k < data.size(); k++) data[k] ^= m.data[k];
+    return *this;
+}
+
+/**
+ * @brief Logiczny iloczyn macierzy metodą czterech Rosjan.
+ *
+ * Wiersze m są grupowane po 8; dla każdej grupy budujemy tablicę 256 sum logicznych
+ * wszystkich podzbiorów tych wierszy (każdy wpis to jeden OR na słowach). Następnie
+ * bajt bitów z wiersza bieżącej macierzy wybiera gotowy wpis, który dopisujemy do wyniku.
+ * Koszt to O(n^3 / (64 * 8)) operacji na słowach.
+ *
+ * @param m Macierz, przez którą mnożymy bieżącą macierz
+ * @return bitmatrix& Odwołanie do obecnego obiektu macierzy
+ */
+bitmatrix& bitmatrix::operator*=(const bitmatrix& m) {
+    if (size != m.size) throw std::invalid_argument("Matrix sizes must be the same");
+    const std::size_t w = static_cast<std::size_t>(slowa);
+    bitmatrix wynik(size);
+    std::vector<std::uint64_t> tablica(256 * w);
+    for (int blok = 0; blok < size; blok += 8) {
+        const int ile = std::min(8, size - blok);
+        for (unsigned maska = 1; maska < (1u << ile); maska++) {
+            const std::uint64_t* poprzedni = &tablica[(maska & (maska - 1)) * w];
+            const std::uint64_t* nowy = m.wiersz(blok + najnizszy_bit(maska));
+            std::uint64_t* wpis = &tablica[maska * w];
+            for (std::size_t k = 0; k < w; k++) wpis[k] = poprzedni[k] | nowy[k];
+        }
+        for (int i = 0; i < size; i++) {
+            const unsigned bajt = static_cast<unsigned>((wiersz(i)[blok >> 6] >> (blok & 63)) & 0xFF);
+            if (bajt == 0) continue;
+            const std::uint64_t* wpis = &tablica[bajt * w];
+            std::uint64_t* cel = wynik.wiersz(i);
+            for (std::size_t k = 0; k < w; k++) cel[k] |= wpis[k];
+        }
+    }
+    data.swap(wynik.data);
+    return *this;
+}
+
+/**
+ * @brief Zastępuje macierz jej domknięciem przechodnim.
+ *
+ * Algorytm Warshalla: dla każdego k, każdy wiersz mający jedynkę w kolumnie k
+ * przejmuje (OR) wiersz k. Operacje na całych słowach dają koszt O(n^3 / 64).
+ * Przekątna zawiera jedynkę tylko dla wierzchołków leżących na cyklu.
+ *
+ * @return bitmatrix& Odwołanie do obecnego obiektu macierzy
+ */
+bitmatrix& bitmatrix::domkniecie() {
+    const std::size_t w = static_cast<std::size_t>(slowa);
+    for (int k = 0; k < size; k++) {
+        const std::uint64_t* wk = wiersz(k);
+        const std::uint64_t bit = std::uint64_t(1) << (k & 63);
+        for (int i = 0; i < size; i++) {
+            std::uint64_t* wi = wiersz(i);
+            if (!(wi[k >> 6] & bit)) continue;
+            for (std::size_t s = 0; s < w; s++) wi[s] |= wk[s];
+        }
+    }
+    return *this;
+}
+
+/**
+ * @brief Operator porównania == dla macierzy.
+ *
+ * @param m Obiekt klasy bitmatrix, z którym porównujemy
+ * @return bool Zwraca true, jeśli macierze są równe
+ */
+bool bitmatrix::operator==(const bitmatrix& m) const {
+    return size == m.size && data == m.data;
+}
+
+// Operator wyjścia
+/**
+ * @brief Operator wyjścia do strumienia.
+ *
+ * @param o Strumień wyjściowy
+ * @param m Obiekt klasy bitmatrix
+ * @return std::ostream& Strumień wyjściowy
+ */
+std::ostream& operator<<(std::ostream& o, const bitmatrix& m) {
+    for (int i = 0; i < m.size; i++) {
+        for (int j = 0; j < m.size; j++) {
+            o << m.pokaz(i, j) << " ";
+        }
+        o << "\n";
+    }
+    return o;
+}
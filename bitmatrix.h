@@ -0,0 +1,189 @@
+/**
+ * @file bitmatrix.h
+ * @brief Definicja klasy bitmatrix - upakowanej bitowo macierzy logicznej.
+ *
+ * Plik nagłówkowy zawiera definicję klasy `bitmatrix`, która przechowuje macierz 0/1
+ * o wymiarach n x n po jednym bicie na element (64 elementy w słowie). Klasa oferuje
+ * wzorce znane z klasy `matrix`, operacje logiczne na całych słowach, iloczyn logiczny
+ * macierzy oraz domknięcie przechodnie, np. dla macierzy sąsiedztwa grafu.
+ */
+
+#ifndef BITMATRIX_H
+#define BITMATRIX_H
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+#include "matrix.h"
+
+/**
+ * @class bitmatrix
+ * @brief Klasa reprezentująca macierz logiczną n x n upakowaną bitowo.
+ *
+ * Każdy wiersz zajmuje ceil(n / 64) słów 64-bitowych; bity poza n-tą kolumną są zawsze zerami.
+ */
+class bitmatrix {
+private:
+    std::vector<std::uint64_t> data; /**< Wiersze macierzy, słowo po słowie */
+    int size;                        /**< Rozmiar macierzy (n x n) */
+    int slowa;                       /**< Liczba słów na wiersz */
+
+    /**
+     * @brief Zwraca wskaźnik na pierwsze słowo wiersza i.
+     * @param i Indeks wiersza.
+     * @return Wskaźnik na słowa wiersza.
+     */
+    std::uint64_t* wiersz(int i);
+
+    /**
+     * @brief Zwraca wskaźnik na pierwsze słowo wiersza i (wersja stała).
+     * @param i Indeks wiersza.
+     * @return Wskaźnik na słowa wiersza.
+     */
+    const std::uint64_t* wiersz(int i) const;
+
+    /**
+     * @brief Zeruje bity poza n-tą kolumną w ostatnim słowie każdego wiersza.
+     */
+    void przytnij();
+
+public:
+    /**
+     * @brief Konstruktor domyślny.
+     * Inicjalizuje pustą macierz.
+     */
+    bitmatrix();
+
+    /**
+     * @brief Konstruktor z wymiarem.
+     * Tworzy wyzerowaną macierz o wymiarach n x n.
+     * @param n Wymiar macierzy.
+     */
+    bitmatrix(int n);
+
+    /**
+     * @brief Konstruktor z macierzy całkowitej.
+     * Elementy niezerowe stają się jedynkami.
+     * @param m Macierz źródłowa.
+     */
+    explicit bitmatrix(const matrix& m);
+
+    /**
+     * @brief Alokuje wyzerowaną macierz o wymiarach n x n.
+     * @param n Rozmiar macierzy.
+     * @return Referencja do obiektu macierzy.
+     */
+    bitmatrix& alokuj(int n);
+
+    /**
+     * @brief Wstawia wartość do macierzy na pozycji (x, y).
+     * @param x Indeks wiersza.
+     * @param y Indeks kolumny.
+     * @param wartosc Wartość do wstawienia.
+     * @return Referencja do obiektu macierzy.
+     */
+    bitmatrix& wstaw(int x, int y, bool wartosc);
+
+    /**
+     * @brief Zwraca wartość elementu macierzy na pozycji (x, y).
+     * @param x Indeks wiersza.
+     * @param y Indeks kolumny.
+     * @return Wartość elementu macierzy.
+     */
+    bool pokaz(int x, int y) const;
+
+    /**
+     * @brief Zwraca rozmiar macierzy.
+     * @return Liczba wierszy (i kolumn) macierzy.
+     */
+    int rozmiar() const;
+
+    /**
+     * @brief Zlicza jedynki w macierzy (liczba krawędzi grafu).
+     * @return Liczba jedynek.
+     */
+    long long liczba_jedynek() const;
+
+    /**
+     * @brief Zamienia macierz na macierz całkowitą 0/1.
+     * @return Nowa macierz całkowita.
+     */
+    matrix do_macierzy() const;
+
+    /**
+     * @brief Tworzy macierz z jedynkami na przekątnej.
+     * @return Referencja do obiektu macierzy.
+     */
+    bitmatrix& przekatna();
+
+    /**
+     * @brief Tworzy macierz z jedynkami poniżej przekątnej.
+     * @return Referencja do obiektu macierzy.
+     */
+    bitmatrix& pod_przekatna();
+
+    /**
+     * @brief Tworzy macierz z jedynkami powyżej przekątnej.
+     * @return Referencja do obiektu macierzy.
+     */
+    bitmatrix& nad_przekatna();
+
+    /**
+     * @brief Tworzy macierz szachownicy.
+     * @return Referencja do obiektu macierzy.
+     */
+    bitmatrix& szachownica();
+
+    /**
+     * @brief Iloczyn logiczny (AND) element po elemencie.
+     * @param m Druga macierz.
+     * @return Referencja do obiektu macierzy.
+     */
+    bitmatrix& operator&=(const bitmatrix& m);
+
+    /**
+     * @brief Suma logiczna (OR) element po elemencie.
+     * @param m Druga macierz.
+     * @return Referencja do obiektu macierzy.
+     */
+    bitmatrix& operator|=(const bitmatrix& m);
+
+    /**
+     * @brief Różnica symetryczna (XOR) element po elemencie.
+     * @param m Druga macierz.
+     * @return Referencja do obiektu macierzy.
+     */
+    bitmatrix& operator^=(const bitmatrix& m);
+
+    /**
+     * @brief Logiczny iloczyn macierzy (metoda czterech Rosjan).
+     * Element (i, j) wyniku to OR po k z (this(i, k) AND m(k, j)).
+     * @param m Druga macierz.
+     * @return Referencja do obiektu wynikowej macierzy.
+     */
+    bitmatrix& operator*=(const bitmatrix& m);
+
+    /**
+     * @brief Zastępuje macierz jej domknięciem przechodnim (algorytm Warshalla na słowach).
+     * @return Referencja do obiektu macierzy.
+     */
+    bitmatrix& domkniecie();
+
+    /**
+     * @brief Operator porównania macierzy (równość).
+     * @param m Druga macierz.
+     * @return True, jeśli macierze są równe, false w przeciwnym razie.
+     */
+    bool operator==(const bitmatrix& m) const;
+
+    /**
+     * @brief Operator wyjścia dla macierzy (do strumienia).
+     * @param o Strumień wyjściowy.
+     * @param m Macierz.
+     * @return Strumień wyjściowy.
+     */
+    friend std::ostream& operator<<(std::ostream& o, const bitmatrix& m);
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "matrix.h"
+#include "bitmatrix.h"
 #include <iostream>
 #include <fstream>
 
@@ -68,8 +69,80 @@ void test_matrix_methods() {
     m2.pod_przekatna();
     std::cout << "Macierz m2 z pod przekątną:\n" << m2 << "\n";
 
+    // Test arytmetyki modularnej
+    const int p = 1000000007;
+    matrix m7(n, data);
+    m7.mnoz_mod(m4, p);
+    std::cout << "Macierz m7 (dane * m4 mod p):\n" << m7 << "\n";
+
+    // Test potęgowania: F(90) mod p z macierzy Fibonacciego
+    int fib[] = {1, 1, 1, 0};
+    matrix m8(2, fib);
+    m8.potega_mod(90, p);
+    std::cout << "F(90) mod p: " << m8.pokaz(0, 1) << "\n";
+
+    // Test wyznacznika, rzędu i rozwiązywania układu
+    int dane_a[] = {2, 1, 1, 1, 3, 2, 1, 0, 0};
+    matrix m9(3, dane_a);
+    std::cout << "Wyznacznik m9: " << m9.wyznacznik() << ", rząd m9: " << m9.rzad() << "\n";
+    std::cout << "Rząd m4: " << m4.rzad() << "\n";
+
+    matrix m11(20);
+    m11.losuj();
+    std::cout << "Wyznacznik losowej macierzy 20x20: " << m11.wyznacznik_dokladny() << "\n";
+
+    int b[] = {4, 5, 6};
+    long long x[3];
+    long long mianownik = m9.rozwiaz(b, x);
+    std::cout << "Rozwiązanie m9 x = b: " << x[0] << "/" << mianownik << " " << x[1] << "/" << mianownik
+              << " " << x[2] << "/" << mianownik << "\n";
+
+    int jedynki[20];
+    std::string liczniki[20];
+    for (int i = 0; i < 20; i++) jedynki[i] = 1;
+    std::string mianownik11 = m11.rozwiaz_dokladnie(jedynki, liczniki);
+    std::cout << "Pierwsza niewiadoma układu m11 x = 1: " << liczniki[0] << "/" << mianownik11 << "\n";
+
+    std::string dolaczona[9];
+    std::string mianownik9 = m9.odwrotna_dokladna(dolaczona);
+    std::cout << "Odwrotność m9 (adj(m9) / " << mianownik9 << "):";
+    for (int i = 0; i < 9; i++) std::cout << (i % 3 ? " " : "\n") << dolaczona[i];
+    std::cout << "\n";
+
+    matrix m10(m9);
+    m10.odwrotna_mod(p);
+    std::cout << "Macierz m10 (odwrotność m9 mod p):\n" << m10 << "\n";
+
+    // Test macierzy bitowej (graf: cykl 0 -> 1 -> 2 -> 3 -> 0)
+    bitmatrix g1(n);
+    g1.wstaw(0, 1, true).wstaw(1, 2, true).wstaw(2, 3, true).wstaw(3, 0, true);
+    bitmatrix g2(g1);
+    g2 *= g1;
+    std::cout << "Macierz g2 (ścieżki długości 2):\n" << g2 << "\n";
+    g1.domkniecie();
+    std::cout << "Domknięcie przechodnie g1 (" << g1.liczba_jedynek() << " jedynek):\n" << g1 << "\n";
+
+    bitmatrix g3(m2);
+    g3 ^= bitmatrix(n).nad_przekatna();
+    std::cout << "Macierz g3 (pod XOR nad przekątną):\n" << g3 << "\n";
+
+    // Test redukcji
+    int wx, wy;
+    std::cout << "Suma m4: " << m4.suma() << ", ślad m4: " << m4.slad()
+              << ", norma Frobeniusa m4: " << m4.norma_frobeniusa() << "\n";
+    int maks = m4.maksimum(&wx, &wy);
+    std::cout << "Maksimum m4: " << maks << " na pozycji (" << wx << ", " << wy << ")\n";
+    int mini = m4.minimum(&wx, &wy);
+    std::cout << "Minimum m4: " << mini << " na pozycji (" << wx << ", " << wy << ")\n";
+
+    long long sumy[4];
+    m4.sumy_wierszy(sumy);
+    std::cout << "Sumy wierszy m4: " << sumy[0] << " " << sumy[1] << " " << sumy[2] << " " << sumy[3] << "\n";
+    m4.sumy_kolumn(sumy);
+    std::cout << "Sumy kolumn m4: " << sumy[0] << " " << sumy[1] << " " << sumy[2] << " " << sumy[3] << "\n";
+
     // Test destruktora
-    std::cout << "Usuwanie macierzy m1, m2, m3, m4, m5, m6...\n";
+    std::cout << "Usuwanie macierzy m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11...\n";
 }
 
 int main() {
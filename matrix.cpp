@@ -3,13 +3,669 @@
 #include <cstdlib>
 #include <ctime>
 #include <stdexcept>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <cmath>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <string>
+#include <utility>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 uint128;
+#endif
+
+/**
+ * @brief Redukcja Barretta dla modułu p < 2^31.
+ *
+ * Przechowuje m = floor((2^64 - 1) / p), dzięki czemu resztę z liczby 64-bitowej
+ * liczymy jednym mnożeniem i co najwyżej jednym odejmowaniem zamiast dzielenia.
+ */
+struct barrett {
+    std::uint64_t p; /**< Moduł */
+    std::uint64_t m; /**< Przybliżona odwrotność modułu */
+
+    explicit barrett(std::uint64_t mod) : p(mod), m(~std::uint64_t(0) / mod) {}
+
+    std::uint64_t redukuj(std::uint64_t x) const {
+#ifdef __SIZEOF_INT128__
+        std::uint64_t q = static_cast<std::uint64_t>((static_cast<uint128>(x) * m) >> 64);
+        std::uint64_t r = x - q * p;
+        return r >= p ? r - p : r;
+#else
+        return x % p;
+#endif
+    }
+};
+
+/**
+ * @brief Sprowadza liczbę całkowitą (także ujemną) do zakresu [0, p).
+ */
+std::uint32_t reszta(int v, int p) {
+    int r = v % p;
+    return static_cast<std::uint32_t>(r < 0 ? r + p : r);
+}
+
+/**
+ * @brief Dodaje a * b[j] do acc[j] dla j z [0, n) (a, b[j] < 2^32).
+ *
+ * Z SSE2 każde _mm_mul_epu32 mnoży dwie pary 32x32->64 bity, a elementy b są
+ * rozszerzane zerami przez rozpakowanie z wektorem zerowym. Autowektoryzacja GCC przy -O2
+ * tej pętli nie obejmuje, a przy -O3 emuluje pełne mnożenie 64x64, które jest wolniejsze
+ * od skalarnego.
+ */
+void dodaj_iloczyny(std::uint64_t* acc, const std::uint32_t* b, std::uint64_t a, std::size_t n) {
+    std::size_t j = 0;
+#if defined(__SSE2__)
+    const __m128i av = _mm_set1_epi64x(static_cast<long long>(a));
+    const __m128i zero = _mm_setzero_si128();
+    for (; j + 4 <= n; j += 4) {
+        const __m128i bv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        __m128i* cel = reinterpret_cast<__m128i*>(acc + j);
+        const __m128i lo = _mm_mul_epu32(_mm_unpacklo_epi32(bv, zero), av);
+        const __m128i hi = _mm_mul_epu32(_mm_unpackhi_epi32(bv, zero), av);
+        _mm_storeu_si128(cel, _mm_add_epi64(_mm_loadu_si128(cel), lo));
+        _mm_storeu_si128(cel + 1, _mm_add_epi64(_mm_loadu_si128(cel + 1), hi));
+    }
+#endif
+    for (; j < n; j++) acc[j] += a * b[j];
+}
+
+void sprawdz_modul(int p) {
+    if (p <= 0) throw std::invalid_argument("Modulus must be positive");
+}
+
+/**
+ * @brief a^k modulo p (szybkie potęgowanie).
+ */
+std::uint64_t potega_skalarna(std::uint64_t a, std::uint64_t k, const barrett& br) {
+    std::uint64_t wynik = 1 % br.p;
+    a = br.redukuj(a);
+    while (k > 0) {
+        if (k & 1) wynik = br.redukuj(wynik * a);
+        a = br.redukuj(a * a);
+        k >>= 1;
+    }
+    return wynik;
+}
+
+/**
+ * @brief Test pierwszości Millera-Rabina, deterministyczny dla n < 2^32 (świadkowie 2, 7, 61).
+ */
+bool czy_pierwsza(std::uint32_t n) {
+    if (n < 2) return false;
+    for (std::uint32_t d : {2u, 3u, 5u, 7u, 61u}) {
+        if (n % d == 0) return n == d;
+    }
+    std::uint32_t d = n - 1;
+    int s = 0;
+    while (!(d & 1u)) {
+        d >>= 1;
+        s++;
+    }
+    const barrett br(n);
+    for (std::uint64_t a : {2u, 7u, 61u}) {
+        std::uint64_t x = potega_skalarna(a, d, br);
+        if (x == 1 || x == n - 1) continue;
+        bool zlozona = true;
+        for (int r = 1; r < s && zlozona; r++) {
+            x = br.redukuj(x * x);
+            if (x == n - 1) zlozona = false;
+        }
+        if (zlozona) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Eliminacja modulo p wymaga odwrotności każdego niezerowego piwota, więc p musi być pierwsze.
+ */
+void sprawdz_pierwsza(int p) {
+    if (p <= 0 || !czy_pierwsza(static_cast<std::uint32_t>(p))) {
+        throw std::invalid_argument("Modulus must be prime");
+    }
+}
+
+/**
+ * @brief Odwrotność a modulo p (rozszerzony algorytm Euklidesa).
+ * @return Odwrotność lub 0, jeśli nie istnieje.
+ */
+std::uint32_t odwrotnosc_mod(std::uint32_t a, std::uint32_t p) {
+    long long r0 = p, r1 = a, t0 = 0, t1 = 1;
+    while (r1 != 0) {
+        long long q = r0 / r1;
+        long long r2 = r0 - q * r1; r0 = r1; r1 = r2;
+        long long t2 = t0 - q * t1; t0 = t1; t1 = t2;
+    }
+    if (r0 != 1) return 0;
+    return static_cast<std::uint32_t>(t0 < 0 ? t0 + p : t0);
+}
+
+/**
+ * @brief Kopiuje macierz n x n do ciągłego bufora reszt modulo p o szerokości `kolumny`.
+ * Dodatkowe kolumny (kolumny > n) są wypełnione zerami.
+ */
+std::vector<std::uint32_t> spakuj_mod(int* const* data, int n, int kolumny, int p) {
+    std::vector<std::uint32_t> a(static_cast<std::size_t>(n) * kolumny, 0);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            a[static_cast<std::size_t>(i) * kolumny + j] = reszta(data[i][j], p);
+        }
+    }
+    return a;
+}
+
+/**
+ * @brief Liczba iloczynów mniejszych od p^2, które można dodać do reszty (< p) w akumulatorze
+ * 64-bitowym przed redukcją; co najwyżej 64, żeby panel wierszy piwotów mieścił się w pamięci podręcznej.
+ */
+int szerokosc_panelu(std::uint32_t p) {
+    const std::uint64_t kwadrat = static_cast<std::uint64_t>(p) * p;
+    const std::uint64_t ile = (~std::uint64_t(0) - p) / kwadrat;
+    return static_cast<int>(std::max<std::uint64_t>(1, std::min<std::uint64_t>(64, ile)));
+}
+
+/**
+ * @brief Eliminacja Gaussa modulo liczba pierwsza p na ciągłym buforze wierszy.
+ * 
+ * Piwoty szukane są w pierwszych `piwoty` kolumnach; wiersz piwota jest normalizowany
+ * do jedynki na przekątnej. Przy `zredukowana` zeruje także elementy nad piwotami
+ * (Gauss-Jordan), co pozwala odczytać odwrotność lub rozwiązanie z dodatkowych kolumn.
+ * 
+ * Wiersze piwotów wprowadzane są do pozostałych wierszy panelami po szerokosc_panelu(p):
+ * mnożnik wiersza względem oczekującego piwota czeka w kolumnie tego piwota, a iloczyny
+ * całego panelu sumowane są w akumulatorach 64-bitowych (dodaj_iloczyny) i redukowane raz
+ * na panel zamiast po każdym piwocie. Na bieżąco uzupełniana jest tylko kolumna, w której
+ * szukamy piwota, oraz wybrany wiersz piwota. Postać zredukowana powstaje na końcu przez
+ * podstawienie wstecz w ten sam sposób.
+ * 
+ * @param a Bufor wierszy (wiersze x kolumny)
+ * @param wiersze Liczba wierszy
+ * @param kolumny Szerokość wiersza
+ * @param piwoty Liczba kolumn, w których szukamy piwotów
+ * @param p Moduł (liczba pierwsza)
+ * @param zredukowana Czy sprowadzić do zredukowanej postaci schodkowej
+ * @param wyznacznik Jeśli niepusty, otrzymuje wyznacznik części kwadratowej modulo p
+ * @return int Rząd (liczba znalezionych piwotów)
+ */
+int eliminuj_mod(std::vector<std::uint32_t>& a, int wiersze, int kolumny, int piwoty,
+                 std::uint32_t p, bool zredukowana, std::uint32_t* wyznacznik) {
+    const barrett br(p);
+    const std::size_t w = static_cast<std::size_t>(kolumny);
+    const std::size_t kafel = 256; // Kolumny zamykane naraz, żeby akumulatory zostały w L1
+    const int panel = szerokosc_panelu(p);
+    auto wiersz = [&](int i) { return &a[static_cast<std::size_t>(i) * w]; };
+    std::vector<std::uint64_t> acc(w);
+    std::vector<int> kol; // Kolumna piwota z wiersza s
+    int otwarte = 0;      // Piwoty [otwarte, r) nie są jeszcze wprowadzone do wierszy poniżej
+
+    // Wprowadza oczekujące piwoty do wierszy [r, wiersze) w kolumnach [od, w) i zeruje ich mnożniki
+    auto zamknij_panel = [&](int r, std::size_t od) {
+        for (std::size_t k0 = od; k0 < w; k0 += kafel) {
+            const std::size_t k1 = std::min(w, k0 + kafel);
+            for (int i = r; i < wiersze; i++) {
+                std::uint32_t* wi = wiersz(i);
+                std::copy(wi + k0, wi + k1, acc.begin());
+                for (int s = otwarte; s < r; s++) {
+                    const std::uint32_t m = wi[kol[s]];
+                    if (m) dodaj_iloczyny(acc.data(), wiersz(s) + k0, p - m, k1 - k0);
+                }
+                for (std::size_t k = k0; k < k1; k++) {
+                    wi[k] = static_cast<std::uint32_t>(br.redukuj(acc[k - k0]));
+                }
+            }
+        }
+        for (int i = r; i < wiersze; i++) {
+            for (int s = otwarte; s < r; s++) wiersz(i)[kol[s]] = 0;
+        }
+        otwarte = r;
+    };
+
+    std::uint64_t det = 1 % p;
+    int r = 0;
+    int c = 0;
+    for (; c < piwoty && r < wiersze; c++) {
+        int piw = -1;
+        for (int i = r; i < wiersze; i++) {
+            std::uint32_t* wi = wiersz(i);
+            std::uint64_t v = wi[c];
+            for (int s = otwarte; s < r; s++) {
+                v += static_cast<std::uint64_t>(p - wi[kol[s]]) * wiersz(s)[c];
+            }
+            wi[c] = static_cast<std::uint32_t>(br.redukuj(v));
+            if (piw < 0 && wi[c] != 0) piw = i;
+        }
+        if (piw < 0) {
+            det = 0;
+            continue;
+        }
+        std::uint32_t* wr = wiersz(r);
+        if (piw != r) {
+            std::swap_ranges(wr, wr + w, wiersz(piw));
+            det = det ? p - det : 0;
+        }
+        if (otwarte < r) {
+            const std::size_t n = w - c - 1;
+            std::copy(wr + c + 1, wr + w, acc.begin());
+            for (int s = otwarte; s < r; s++) {
+                const std::uint32_t m = wr[kol[s]];
+                if (m) dodaj_iloczyny(acc.data(), wiersz(s) + c + 1, p - m, n);
+                wr[kol[s]] = 0;
+            }
+            for (std::size_t k = 0; k < n; k++) {
+                wr[c + 1 + k] = static_cast<std::uint32_t>(br.redukuj(acc[k]));
+            }
+        }
+        det = br.redukuj(det * wr[c]);
+        const std::uint64_t odw = odwrotnosc_mod(wr[c], p);
+        for (std::size_t k = c; k < w; k++) {
+            wr[k] = static_cast<std::uint32_t>(br.redukuj(odw * wr[k]));
+        }
+        kol.push_back(c);
+        r++;
+        if (r - otwarte == panel) zamknij_panel(r, c + 1);
+    }
+    zamknij_panel(r, c);
+
+    if (zredukowana) {
+        // Wiersze poniżej k są już zredukowane, więc wystarczą oryginalne mnożniki wiersza k
+        const bool pelny = r == piwoty;
+        for (int k = r - 1; k >= 0; k--) {
+            std::uint32_t* wk = wiersz(k);
+            const std::size_t od = pelny ? static_cast<std::size_t>(piwoty) : kol[k] + 1;
+            const std::size_t n = w - od;
+            std::copy(wk + od, wk + w, acc.begin());
+            int skladniki = 0;
+            for (int s = k + 1; s < r; s++) {
+                const std::uint32_t m = wk[kol[s]];
+                if (m == 0) continue;
+                if (skladniki == panel) {
+                    for (std::size_t j = 0; j < n; j++) acc[j] = br.redukuj(acc[j]);
+                    skladniki = 0;
+                }
+                dodaj_iloczyny(acc.data(), wiersz(s) + od, p - m, n);
+                skladniki++;
+            }
+            for (std::size_t j = 0; j < n; j++) wk[od + j] = static_cast<std::uint32_t>(br.redukuj(acc[j]));
+            if (pelny) {
+                std::fill(wk, wk + piwoty, 0u);
+                wk[kol[k]] = 1;
+            }
+        }
+    }
+    if (r < piwoty) det = 0;
+    if (wyznacznik) *wyznacznik = static_cast<std::uint32_t>(det);
+    return r;
+}
+
+/**
+ * @brief Moduły metod wielomodularnych są mniejsze od 2^28, żeby eliminacja mogła
+ * sumować pełne panele 64 iloczynów przed redukcją.
+ */
+constexpr std::uint32_t granica_modulow = 1u << 28;
+
+/**
+ * @brief Największa liczba pierwsza mniejsza od p.
+ */
+std::uint32_t poprzednia_pierwsza(std::uint32_t p) {
+    do {
+        p--;
+    } while (!czy_pierwsza(p));
+    return p;
+}
+
+/**
+ * @brief Liczba całkowita dowolnej wielkości: znak i moduł w cyfrach o podstawie 2^32.
+ */
+struct duza_liczba {
+    bool ujemna = false;             /**< Znak */
+    std::vector<std::uint32_t> cyfry; /**< Moduł, od najmłodszej cyfry; pusty dla zera */
+
+    /**
+     * @brief this = this * m + d (m, d < 2^32).
+     */
+    void pomnoz_dodaj(std::uint32_t m, std::uint32_t d) {
+        std::uint64_t przeniesienie = d;
+        for (std::uint32_t& c : cyfry) {
+            const std::uint64_t v = static_cast<std::uint64_t>(c) * m + przeniesienie;
+            c = static_cast<std::uint32_t>(v);
+            przeniesienie = v >> 32;
+        }
+        if (przeniesienie) cyfry.push_back(static_cast<std::uint32_t>(przeniesienie));
+    }
+
+    /**
+     * @brief Reszta z dzielenia przez p z przedziału [0, p) (także dla liczb ujemnych).
+     */
+    std::uint32_t modulo(std::uint32_t p) const {
+        std::uint64_t r = 0;
+        for (std::size_t i = cyfry.size(); i-- > 0;) r = ((r << 32) | cyfry[i]) % p;
+        return static_cast<std::uint32_t>(ujemna && r ? p - r : r);
+    }
+
+    /**
+     * @brief Zamienia na long long, jeśli wartość się mieści.
+     * @return bool Czy wartość mieści się w long long
+     */
+    bool do_long_long(long long& wynik) const {
+        if (cyfry.size() > 2) return false;
+        std::uint64_t v = 0;
+        for (std::size_t i = cyfry.size(); i-- > 0;) v = (v << 32) | cyfry[i];
+        const std::uint64_t granica = static_cast<std::uint64_t>(1) << 63;
+        if (ujemna) {
+            if (v > granica) return false;
+            wynik = v == granica ? std::numeric_limits<long long>::min() : -static_cast<long long>(v);
+        } else {
+            if (v >= granica) return false;
+            wynik = static_cast<long long>(v);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Zapis dziesiętny (dzielenie przez 10^9 cyfra po cyfrze).
+     */
+    std::string dziesietnie() const {
+        if (cyfry.empty()) return "0";
+        std::vector<std::uint32_t> v(cyfry);
+        std::vector<std::uint32_t> kawalki; // Cyfry o podstawie 10^9, od najmłodszej
+        while (!v.empty()) {
+            std::uint64_t r = 0;
+            for (std::size_t i = v.size(); i-- > 0;) {
+                const std::uint64_t cur = (r << 32) | v[i];
+                v[i] = static_cast<std::uint32_t>(cur / 1000000000u);
+                r = cur % 1000000000u;
+            }
+            while (!v.empty() && v.back() == 0) v.pop_back();
+            kawalki.push_back(static_cast<std::uint32_t>(r));
+        }
+        std::string wynik = ujemna ? "-" : "";
+        wynik += std::to_string(kawalki.back());
+        for (std::size_t i = kawalki.size() - 1; i-- > 0;) {
+            const std::string kawalek = std::to_string(kawalki[i]);
+            wynik += std::string(9 - kawalek.size(), '0') + kawalek;
+        }
+        return wynik;
+    }
+};
+
+/**
+ * @brief Dobiera kolejne liczby pierwsze < granica_modulow, aż ich iloczyn M przekroczy 4 * 2^log2_ograniczenie.
+ * Zapas 4x pozwala odczytać znak wyniku z najstarszej cyfry w algorytmie Garnera.
+ * 
+ * @param log2_ograniczenie log2 ograniczenia |wynik|
+ * @param pomin Jeśli niepusty i niezerowy, pomijane są liczby pierwsze dzielące tę wartość
+ * @return std::vector<std::uint32_t> Moduły
+ */
+std::vector<std::uint32_t> dobierz_moduly(double log2_ograniczenie, const duza_liczba* pomin = nullptr) {
+    std::vector<std::uint32_t> moduly;
+    double bity = 0.0;
+    std::uint32_t p = granica_modulow;
+    while (bity < log2_ograniczenie + 2.0) {
+        p = poprzednia_pierwsza(p);
+        if (pomin && !pomin->cyfry.empty() && pomin->modulo(p) == 0) continue;
+        moduly.push_back(p);
+        bity += std::log2(static_cast<double>(p));
+    }
+    return moduly;
+}
+
+/**
+ * @brief Odtwarza liczby całkowite z reszt modulo ustalone liczby pierwsze (algorytm Garnera).
+ * 
+ * Cyfry t_i systemu mieszanego (x = t_0 + p_0 (t_1 + p_1 (t_2 + ...))) liczone są w O(k^2)
+ * operacjach modularnych, a następnie składane schematem Hornera w cyfry o podstawie 2^32.
+ * Iloczyny modułów i ich odwrotności zależą tylko od modułów, więc liczone są raz
+ * dla wszystkich odtwarzanych wartości.
+ * Moduły są dobrane tak, że |wynik| < M/4, więc wynik jest ujemny dokładnie wtedy, gdy
+ * najstarsza cyfra przekracza p_{k-1} / 2; wtedy |wynik| = M - x ma cyfry p_i - 1 - t_i plus 1.
+ */
+struct garner {
+    std::vector<std::uint32_t> moduly;      /**< Moduły (różne liczby pierwsze) */
+    std::vector<std::uint32_t> iloczyny;    /**< Wiersz i: p_0 * ... * p_{j-1} mod p_i dla j < i */
+    std::vector<std::uint32_t> odwrotnosci; /**< (p_0 * ... * p_{i-1})^{-1} mod p_i */
+
+    explicit garner(std::vector<std::uint32_t> m)
+        : moduly(std::move(m)), iloczyny(moduly.size() * moduly.size()), odwrotnosci(moduly.size()) {
+        const std::size_t k = moduly.size();
+        for (std::size_t i = 0; i < k; i++) {
+            const barrett br(moduly[i]);
+            std::uint64_t pref = 1;
+            for (std::size_t j = 0; j < i; j++) {
+                iloczyny[i * k + j] = static_cast<std::uint32_t>(pref);
+                pref = br.redukuj(pref * (moduly[j] % moduly[i]));
+            }
+            odwrotnosci[i] = odwrotnosc_mod(static_cast<std::uint32_t>(pref), moduly[i]);
+        }
+    }
+
+    /**
+     * @brief Odtwarza wartość z reszt modulo kolejne moduły.
+     */
+    duza_liczba odtworz(const std::uint32_t* reszty) const {
+        const std::size_t k = moduly.size();
+        std::vector<std::uint32_t> t(k);
+        for (std::size_t i = 0; i < k; i++) {
+            const barrett br(moduly[i]);
+            std::uint64_t x = 0;
+            for (std::size_t j = 0; j < i; j++) x = br.redukuj(x + static_cast<std::uint64_t>(t[j]) * iloczyny[i * k + j]);
+            const std::uint64_t roznica = br.redukuj(static_cast<std::uint64_t>(reszty[i]) + moduly[i] - x);
+            t[i] = static_cast<std::uint32_t>(br.redukuj(roznica * odwrotnosci[i]));
+        }
+        duza_liczba wynik;
+        if (k == 0) return wynik;
+        wynik.ujemna = t[k - 1] > moduly[k - 1] / 2;
+        for (std::size_t i = k; i-- > 0;) {
+            wynik.pomnoz_dodaj(moduly[i], wynik.ujemna ? moduly[i] - 1 - t[i] : t[i]);
+        }
+        if (wynik.ujemna) wynik.pomnoz_dodaj(1, 1);
+        while (!wynik.cyfry.empty() && wynik.cyfry.back() == 0) wynik.cyfry.pop_back();
+        if (wynik.cyfry.empty()) wynik.ujemna = false;
+        return wynik;
+    }
+};
+
+/**
+ * @brief Uruchamia zadanie(i) dla i z [0, ile) na puli wątków.
+ * Każde zadanie zapisuje wyłącznie własny wynik, więc kolejność wykonania nie wpływa na rezultat.
+ * Wyjątek rzucony przez zadanie jest przechwytywany w wątku i po zakończeniu wszystkich wątków
+ * rzucany ponownie u wywołującego (przy kilku wyjątkach - ten z najmniejszego i).
+ */
+template <typename F>
+void rownolegle(int ile, F zadanie) {
+    const unsigned watki = std::min<unsigned>(std::max(1u, std::thread::hardware_concurrency()),
+                                              static_cast<unsigned>(std::max(ile, 0)));
+    if (watki <= 1) {
+        for (int i = 0; i < ile; i++) zadanie(i);
+        return;
+    }
+    std::atomic<int> nastepne(0);
+    std::vector<std::exception_ptr> bledy(ile);
+    std::vector<std::thread> pula;
+    for (unsigned w = 0; w < watki; w++) {
+        pula.emplace_back([&] {
+            for (int i = nastepne++; i < ile; i = nastepne++) {
+                try {
+                    zadanie(i);
+                } catch (...) {
+                    bledy[i] = std::current_exception();
+                }
+            }
+        });
+    }
+    for (auto& t : pula) t.join();
+    for (const std::exception_ptr& blad : bledy) {
+        if (blad) std::rethrow_exception(blad);
+    }
+}
+
+/**
+ * @brief Dzieli n wierszy na bloki dla redukcji równoległych.
+ * Blok obejmuje co najmniej ~64k elementów, żeby koszt wątku nie przeważał nad pracą.
+ */
+int bloki_wierszy(int n) {
+    const long long elementy = static_cast<long long>(n) * n;
+    const long long bloki = std::min<long long>({static_cast<long long>(std::max(1u, std::thread::hardware_concurrency())),
+                                                 std::max<long long>(1, elementy >> 16), std::max(n, 1)});
+    return static_cast<int>(bloki);
+}
+
+/**
+ * @brief Zakres wierszy [poczatek, koniec) bloku b spośród `bloki` bloków.
+ */
+void zakres_bloku(int n, int bloki, int b, int& poczatek, int& koniec) {
+    poczatek = static_cast<int>(static_cast<long long>(n) * b / bloki);
+    koniec = static_cast<int>(static_cast<long long>(n) * (b + 1) / bloki);
+}
+
+/**
+ * @brief Znajduje skrajny element macierzy n x n względem porządku `lepszy` (minimum dla
+ * std::less, maksimum dla std::greater) oraz jego pierwsze wystąpienie w kolejności wierszy.
+ * 
+ * Najpierw równolegle liczymy skrajną wartość każdego bloku wierszy prostą pętlą bez
+ * rozgałęzień, a dopiero potem szukamy pierwszej pozycji tej wartości.
+ * 
+ * @throws std::length_error Jeśli macierz jest pusta
+ */
+template <typename Porzadek>
+int skrajny_element(int* const* data, int n, Porzadek lepszy, int* x, int* y) {
+    if (n == 0) throw std::length_error("Matrix is empty");
+    const int bloki = bloki_wierszy(n);
+    std::vector<int> skrajne(bloki);
+    rownolegle(bloki, [&](int b) {
+        int poczatek, koniec;
+        zakres_bloku(n, bloki, b, poczatek, koniec);
+        int m = data[poczatek][0];
+        for (int i = poczatek; i < koniec; i++) {
+            const int* w = data[i];
+            for (int j = 0; j < n; j++) m = lepszy(w[j], m) ? w[j] : m;
+        }
+        skrajne[b] = m;
+    });
+    const int wynik = *std::min_element(skrajne.begin(), skrajne.end(), lepszy);
+    if (x || y) {
+        for (int i = 0; i < n; i++) {
+            const int* w = std::find(data[i], data[i] + n, wynik);
+            if (w != data[i] + n) {
+                if (x) *x = i;
+                if (y) *y = static_cast<int>(w - data[i]);
+                break;
+            }
+        }
+    }
+    return wynik;
+}
+
+/**
+ * @brief Dokładny wyznacznik macierzy n x n metodą wielomodularną.
+ * 
+ * Liczba modułów wynika z ograniczenia Hadamarda |det| <= prod ||wiersz_i||.
+ * Wyznaczniki modulo kolejne liczby pierwsze liczone są równolegle, a wynik
+ * składany jest z reszt przez CRT.
+ */
+duza_liczba wyznacznik_crt(int* const* data, int n) {
+    double log2_hadamard = 0.0;
+    for (int i = 0; i < n; i++) {
+        double norma = 0.0;
+        for (int j = 0; j < n; j++) {
+            norma += static_cast<double>(data[i][j]) * data[i][j];
+        }
+        if (norma == 0.0) return duza_liczba();
+        log2_hadamard += 0.5 * std::log2(norma);
+    }
+    const garner crt(dobierz_moduly(log2_hadamard));
+    const int k = static_cast<int>(crt.moduly.size());
+    std::vector<std::uint32_t> reszty(k);
+    rownolegle(k, [&](int i) {
+        std::vector<std::uint32_t> a = spakuj_mod(data, n, n, static_cast<int>(crt.moduly[i]));
+        eliminuj_mod(a, n, n, n, crt.moduly[i], false, &reszty[i]);
+    });
+    return crt.odtworz(reszty.data());
+}
+
+/**
+ * @brief Dokładnie rozwiązuje A X = B dla m prawych stron metodą wielomodularną.
+ * 
+ * Licznik X_ij = D x_ij jest wyznacznikiem A z kolumną i zastąpioną kolumną j macierzy B
+ * (wzory Cramera), więc z nierówności Hadamarda jest ograniczony przez iloczyn po wierszach r
+ * pierwiastków z ||a_r||^2 + max_j b_rj^2. Dla każdej liczby pierwszej niedzielącej D = det(A)
+ * rozwiązanie modulo p pomnożone przez D daje reszty liczników; liczniki składane są przez CRT.
+ * 
+ * @param prawe Prawe strony wierszami (n x m); pusty wskaźnik oznacza macierz jednostkową
+ * (m = n), wtedy liczniki tworzą macierz dołączoną adj(A)
+ * @param liczniki Otrzymuje n x m liczników wierszami
+ * @return duza_liczba Wspólny mianownik D = det(A)
+ * @throws std::domain_error Jeśli macierz jest osobliwa
+ */
+duza_liczba rozwiaz_crt(int* const* data, int n, const int* prawe, int m, std::vector<duza_liczba>& liczniki) {
+    const duza_liczba d = wyznacznik_crt(data, n);
+    if (d.cyfry.empty()) throw std::domain_error("Matrix is singular");
+
+    double log2_ograniczenie = 0.0;
+    for (int i = 0; i < n; i++) {
+        double norma = prawe ? 0.0 : 1.0;
+        for (int j = 0; prawe && j < m; j++) {
+            norma = std::max(norma, static_cast<double>(prawe[i * m + j]) * prawe[i * m + j]);
+        }
+        for (int j = 0; j < n; j++) {
+            norma += static_cast<double>(data[i][j]) * data[i][j];
+        }
+        log2_ograniczenie += 0.5 * std::log2(norma);
+    }
+    // Moduły dzielące D nie dają rozwiązania, więc są pomijane
+    const garner crt(dobierz_moduly(log2_ograniczenie, &d));
+    const int k = static_cast<int>(crt.moduly.size());
+
+    const int w = n + m;
+    std::vector<std::uint32_t> reszty(static_cast<std::size_t>(n) * m * k);
+    rownolegle(k, [&](int q) {
+        const int p = static_cast<int>(crt.moduly[q]);
+        const barrett br(crt.moduly[q]);
+        std::vector<std::uint32_t> a = spakuj_mod(data, n, w, p);
+        for (int i = 0; i < n; i++) {
+            std::uint32_t* prawa = &a[static_cast<std::size_t>(i) * w + n];
+            if (prawe) {
+                for (int j = 0; j < m; j++) prawa[j] = reszta(prawe[i * m + j], p);
+            } else {
+                prawa[i] = 1;
+            }
+        }
+        eliminuj_mod(a, n, w, n, crt.moduly[q], true, nullptr);
+        const std::uint64_t dp = d.modulo(crt.moduly[q]);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < m; j++) {
+                reszty[(static_cast<std::size_t>(i) * m + j) * k + q] =
+                    static_cast<std::uint32_t>(br.redukuj(dp * a[static_cast<std::size_t>(i) * w + n + j]));
+            }
+        }
+    });
+    liczniki.assign(static_cast<std::size_t>(n) * m, duza_liczba());
+    rownolegle(n, [&](int i) {
+        for (int j = 0; j < m; j++) {
+            const std::size_t idx = static_cast<std::size_t>(i) * m + j;
+            liczniki[idx] = crt.odtworz(&reszty[idx * k]);
+        }
+    });
+    return d;
+}
+
+} // namespace
 
 // Konstruktor domyślny
 /**
  * @brief Konstruktor domyślny klasy matrix. 
  * Inicjalizuje macierz o rozmiarze 0.
  */
-matrix::matrix() : data(nullptr), size(0) {}
+matrix::matrix() : buf(nullptr), data(nullptr), size(0) {}
 
 // Konstruktor z wymiarem
 /**
@@ -42,16 +698,12 @@ matrix::matrix(int n, int* t) : size(n) {
 // Konstruktor kopiujący
 /**
  * @brief Konstruktor kopiujący, który tworzy nową macierz jako kopię innej.
+ * Kopia w czasie O(1): współdzieli bufor z m i zwiększa jego licznik referencji.
  * 
  * @param m Obiekt klasy matrix, który ma zostać skopiowany.
  */
-matrix::matrix(const matrix& m) : size(m.size) {
-    allocateMemory(size);
-    for (int i = 0; i < size; i++) {
-        for (int j = 0; j < size; j++) {
-            data[i][j] = m.data[i][j];
-        }
-    }
+matrix::matrix(const matrix& m) : buf(m.buf), data(m.data), size(m.size) {
+    if (buf) buf->licznik.fetch_add(1, std::memory_order_relaxed);
 }
 
 // Destruktor
@@ -70,25 +722,47 @@ matrix::~matrix() {
  * @param n Rozmiar macierzy (n x n)
  */
 void matrix::allocateMemory(int n) {
-    data = new int*[n];
+    buf = new bufor;
+    buf->licznik.store(1, std::memory_order_relaxed);
+    buf->elementy = new int[static_cast<std::size_t>(n) * n] {};  // Inicjalizuje macierz zerami
+    buf->wiersze = new int*[n];
     for (int i = 0; i < n; i++) {
-        data[i] = new int[n] {};  // Inicjalizuje macierz zerami
+        buf->wiersze[i] = buf->elementy + static_cast<std::size_t>(i) * n;
     }
+    data = buf->wiersze;
 }
 
 // Dealokacja pamięci
 /**
  * @brief Zwalnia pamięć alokowaną dla macierzy.
+ * Bufor jest usuwany dopiero przez ostatnią korzystającą z niego macierz.
  */
 void matrix::deallocateMemory() {
-    for (int i = 0; i < size; i++) {
-        delete[] data[i];
+    if (buf && buf->licznik.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete[] buf->wiersze;
+        delete[] buf->elementy;
+        delete buf;
     }
-    delete[] data;
+    buf = nullptr;
     data = nullptr;
     size = 0;
 }
 
+// Odłączenie od współdzielonego bufora
+/**
+ * @brief Przygotowuje macierz do modyfikacji (copy-on-write).
+ * Jeśli bufor ma innych właścicieli, elementy są kopiowane do nowego bufora.
+ */
+void matrix::odlacz() {
+    if (!buf || buf->licznik.load(std::memory_order_acquire) == 1) return;
+    matrix stara(*this);
+    const int n = size;
+    deallocateMemory();
+    size = n;
+    allocateMemory(n);
+    std::copy(stara.buf->elementy, stara.buf->elementy + static_cast<std::size_t>(n) * n, buf->elementy);
+}
+
 // Metody klasowe
 
 /**
@@ -114,6 +788,7 @@ matrix& matrix::alokuj(int n) {
  */
 matrix& matrix::wstaw(int x, int y, int wartosc) {
     if (x < size && y < size) {
+        odlacz();
         data[x][y] = wartosc;
     }
     return *this;
@@ -134,6 +809,15 @@ int matrix::pokaz(int x, int y) const {
     throw std::out_of_range("Index out of range");
 }
 
+/**
+ * @brief Zwraca rozmiar macierzy.
+ * 
+ * @return int Liczba wierszy (i kolumn) macierzy
+ */
+int matrix::rozmiar() const {
+    return size;
+}
+
 /**
  * @brief Tworzy macierz transponowaną (zamienia wiersze z kolumnami).
  * 
@@ -156,6 +840,7 @@ matrix& matrix::dowroc() {
  * @return matrix& Odwołanie do obecnego obiektu macierzy
  */
 matrix& matrix::losuj() {
+    odlacz();
     std::srand(static_cast<unsigned int>(std::time(0))); // Inicjalizacja generatora losowego
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
@@ -172,6 +857,7 @@ matrix& matrix::losuj() {
  * @return matrix& Odwołanie do obecnego obiektu macierzy
  */
 matrix& matrix::diagonalna(int* t) {
+    odlacz();
     for (int i = 0; i < size; i++) {
         data[i][i] = t[i]; // Ustawienie wartości na przekątnej
     }
@@ -184,6 +870,7 @@ matrix& matrix::diagonalna(int* t) {
  * @return matrix& Odwołanie do obecnego obiektu macierzy
  */
 matrix& matrix::szachownica() {
+    odlacz();
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
             data[i][j] = (i + j) % 2; // 1 lub 0 w zależności od sumy indeksów
@@ -198,6 +885,7 @@ matrix& matrix::szachownica() {
  * @return matrix& Odwołanie do obecnego obiektu macierzy
  */
 matrix& matrix::przekatna() {
+    odlacz();
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
             data[i][j] = (i == j) ? 1 : 0;
@@ -212,6 +900,7 @@ matrix& matrix::przekatna() {
  * @return matrix& Odwołanie do obecnego obiektu macierzy
  */
 matrix& matrix::pod_przekatna() {
+    odlacz();
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
             data[i][j] = (i > j) ? 1 : 0;
@@ -226,6 +915,7 @@ matrix& matrix::pod_przekatna() {
  * @return matrix& Odwołanie do obecnego obiektu macierzy
  */
 matrix& matrix::nad_przekatna() {
+    odlacz();
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
             data[i][j] = (i < j) ? 1 : 0;
@@ -260,15 +950,12 @@ std::ostream& operator<<(std::ostream& o, const matrix& m) {
  * @return matrix& Odwołanie do obecnego obiektu macierzy
  */
 matrix& matrix::operator=(const matrix& m) {
-    if (this == &m) return *this;
+    if (buf == m.buf) return *this;
+    if (m.buf) m.buf->licznik.fetch_add(1, std::memory_order_relaxed);
     if (data) deallocateMemory();
+    buf = m.buf;
+    data = m.data;
     size = m.size;
-    allocateMemory(size);
-    for (int i = 0; i < size; i++) {
-        for (int j = 0; j < size; j++) {
-            data[i][j] = m.data[i][j];
-        }
-    }
     return *this;
 }
 
@@ -279,6 +966,7 @@ matrix& matrix::operator=(const matrix& m) {
  * @return matrix& Odwołanie do obecnego obiektu macierzy
  */
 matrix& matrix::operator=(double a) {
+    odlacz();
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
             data[i][j] = static_cast<int>(a);
@@ -311,6 +999,7 @@ matrix& matrix::operator+(const matrix& m) {
  * @return matrix& Odwołanie do obecnego obiektu macierzy
  */
 matrix& matrix::operator*(int a) {
+    odlacz();
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
             data[i][j] *= a;
@@ -326,6 +1015,7 @@ matrix& matrix::operator*(int a) {
  * @return matrix& Odwołanie do obecnego obiektu macierzy
  */
 matrix& matrix::operator+=(int a) {
+    odlacz();
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
             data[i][j] += a;
@@ -379,3 +1069,488 @@ bool matrix::operator<(const matrix& m) const {
     }
     return true;
 }
+
+/**
+ * @brief Operator mnożenia macierzy.
+ * Pętle w kolejności i-k-j przechodzą po wierszach obu macierzy sekwencyjnie.
+ * 
+ * @param m Macierz, przez którą mnożymy bieżącą macierz
+ * @return matrix& Odwołanie do obecnego obiektu macierzy
+ */
+matrix& matrix::operator*(const matrix& m) {
+    if (size != m.size) throw std::invalid_argument("Matrix sizes must be the same");
+    matrix temp(size);
+    for (int i = 0; i < size; i++) {
+        for (int k = 0; k < size; k++) {
+            const int a = data[i][k];
+            if (a == 0) continue;
+            for (int j = 0; j < size; j++) {
+                temp.data[i][j] += a * m.data[k][j];
+            }
+        }
+    }
+    return *this = temp;
+}
+
+// Arytmetyka modularna
+
+/**
+ * @brief Redukuje wszystkie elementy macierzy modulo p do zakresu [0, p).
+ * 
+ * @param p Moduł
+ * @return matrix& Odwołanie do obecnego obiektu macierzy
+ * @throws std::invalid_argument Jeśli p nie jest dodatnie
+ */
+matrix& matrix::modulo(int p) {
+    sprawdz_modul(p);
+    odlacz();
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            data[i][j] = static_cast<int>(reszta(data[i][j], p));
+        }
+    }
+    return *this;
+}
+
+/**
+ * @brief Dodaje macierz m modulo p.
+ * 
+ * @param m Macierz, którą dodajemy do bieżącej macierzy
+ * @param p Moduł
+ * @return matrix& Odwołanie do obecnego obiektu macierzy
+ * @throws std::invalid_argument Jeśli rozmiary się różnią lub p nie jest dodatnie
+ */
+matrix& matrix::dodaj_mod(const matrix& m, int p) {
+    if (size != m.size) throw std::invalid_argument("Matrix sizes must be the same");
+    sprawdz_modul(p);
+    odlacz();
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            std::uint32_t s = reszta(data[i][j], p) + reszta(m.data[i][j], p);
+            data[i][j] = static_cast<int>(s >= static_cast<std::uint32_t>(p) ? s - p : s);
+        }
+    }
+    return *this;
+}
+
+/**
+ * @brief Mnoży macierz przez macierz m modulo p.
+ * 
+ * Elementy m są najpierw redukowane do ciągłej tablicy 32-bitowej. Wiersz wyniku
+ * jest sumowany w akumulatorach 64-bitowych (pętla wewnętrzna to mnożenie
+ * 32x32->64 z dodawaniem, wektorowe w dodaj_iloczyny), a redukcja Barretta
+ * wykonywana jest tylko co `limit` iloczynów, tuż zanim akumulator mógłby się przepełnić.
+ * 
+ * @param m Macierz, przez którą mnożymy bieżącą macierz
+ * @param p Moduł
+ * @return matrix& Odwołanie do obecnego obiektu macierzy
+ * @throws std::invalid_argument Jeśli rozmiary się różnią lub p nie jest dodatnie
+ */
+matrix& matrix::mnoz_mod(const matrix& m, int p) {
+    if (size != m.size) throw std::invalid_argument("Matrix sizes must be the same");
+    sprawdz_modul(p);
+    const barrett br(static_cast<std::uint64_t>(p));
+    const std::uint64_t pm1 = static_cast<std::uint64_t>(p) - 1;
+    // Ile iloczynów (każdy <= (p-1)^2) mieści się w akumulatorze bez przepełnienia
+    const std::uint64_t limit = pm1 ? ~std::uint64_t(0) / (pm1 * pm1) : ~std::uint64_t(0);
+    const std::size_t n = static_cast<std::size_t>(size);
+
+    std::vector<std::uint32_t> b(n * n);
+    for (std::size_t k = 0; k < n; k++) {
+        for (std::size_t j = 0; j < n; j++) {
+            b[k * n + j] = reszta(m.data[k][j], p);
+        }
+    }
+
+    matrix temp(size);
+    std::vector<std::uint64_t> acc(n);
+    for (std::size_t i = 0; i < n; i++) {
+        std::fill(acc.begin(), acc.end(), 0);
+        std::uint64_t licznik = 0;
+        for (std::size_t k = 0; k < n; k++) {
+            const std::uint64_t a = reszta(data[i][k], p);
+            if (a == 0) continue;
+            dodaj_iloczyny(acc.data(), &b[k * n], a, n);
+            if (++licznik == limit) {
+                for (std::size_t j = 0; j < n; j++) {
+                    acc[j] = br.redukuj(acc[j]);
+                }
+                licznik = 1; // Zredukowana wartość (< p) liczy się jak jeden iloczyn
+            }
+        }
+        for (std::size_t j = 0; j < n; j++) {
+            temp.data[i][j] = static_cast<int>(br.redukuj(acc[j]));
+        }
+    }
+    return *this = temp;
+}
+
+/**
+ * @brief Podnosi macierz do potęgi k przez wielokrotne podnoszenie do kwadratu.
+ * 
+ * @param k Wykładnik
+ * @return matrix& Odwołanie do obecnego obiektu macierzy
+ * @throws std::invalid_argument Jeśli k jest ujemne
+ */
+matrix& matrix::potega(int k) {
+    if (k < 0) throw std::invalid_argument("Exponent must be non-negative");
+    matrix wynik(size);
+    wynik.przekatna();
+    matrix baza(*this);
+    while (k > 0) {
+        if (k & 1) wynik * baza;
+        k >>= 1;
+        if (k) baza * baza;
+    }
+    return *this = wynik;
+}
+
+/**
+ * @brief Podnosi macierz do potęgi k modulo p przez wielokrotne podnoszenie do kwadratu.
+ * Wykonuje O(log k) mnożeń modularnych, przydatne przy szybkim liczeniu rekurencji liniowych.
+ * 
+ * @param k Wykładnik
+ * @param p Moduł
+ * @return matrix& Odwołanie do obecnego obiektu macierzy
+ * @throws std::invalid_argument Jeśli k jest ujemne lub p nie jest dodatnie
+ */
+matrix& matrix::potega_mod(long long k, int p) {
+    if (k < 0) throw std::invalid_argument("Exponent must be non-negative");
+    sprawdz_modul(p);
+    matrix wynik(size);
+    wynik.przekatna().modulo(p);
+    matrix baza(*this);
+    baza.modulo(p);
+    while (k > 0) {
+        if (k & 1) wynik.mnoz_mod(baza, p);
+        k >>= 1;
+        if (k) baza.mnoz_mod(baza, p);
+    }
+    return *this = wynik;
+}
+
+// Algebra liniowa (dokładna)
+
+/**
+ * @brief Oblicza wyznacznik macierzy modulo liczba pierwsza p eliminacją Gaussa.
+ * 
+ * @param p Moduł (liczba pierwsza)
+ * @return int Wyznacznik modulo p
+ * @throws std::invalid_argument Jeśli p nie jest liczbą pierwszą
+ */
+int matrix::wyznacznik_mod(int p) const {
+    sprawdz_pierwsza(p);
+    std::vector<std::uint32_t> a = spakuj_mod(data, size, size, p);
+    std::uint32_t det = 0;
+    eliminuj_mod(a, size, size, size, static_cast<std::uint32_t>(p), false, &det);
+    return static_cast<int>(det);
+}
+
+/**
+ * @brief Oblicza dokładny wyznacznik metodą wielomodularną.
+ * 
+ * @return long long Wyznacznik macierzy
+ * @throws std::overflow_error Jeśli wyznacznik nie mieści się w long long
+ */
+long long matrix::wyznacznik() const {
+    long long wynik = 0;
+    if (!wyznacznik_crt(data, size).do_long_long(wynik)) {
+        throw std::overflow_error("Determinant exceeds long long range");
+    }
+    return wynik;
+}
+
+/**
+ * @brief Oblicza dokładny wyznacznik dowolnej wielkości metodą wielomodularną.
+ * Liczba modułów rośnie z ograniczeniem Hadamarda (~n log2(||wiersz||) / 28).
+ * 
+ * @return std::string Zapis dziesiętny wyznacznika
+ */
+std::string matrix::wyznacznik_dokladny() const {
+    return wyznacznik_crt(data, size).dziesietnie();
+}
+
+/**
+ * @brief Oblicza dokładny rząd macierzy nad liczbami wymiernymi.
+ * 
+ * Rząd modulo p nigdy nie przekracza rzędu nad Q. Jeśli r jest największym rzędem
+ * uzyskanym dla użytych liczb pierwszych, każda z nich dzieli wszystkie minory stopnia r + 1,
+ * a więc dzieli je też ich iloczyn M. Z nierówności Hadamarda każdy taki minor ma moduł
+ * co najwyżej H_{r+1}, czyli iloczyn r + 1 największych norm wierszy. Gdy M > H_{r+1},
+ * wszystkie minory stopnia r + 1 są zerowe i rząd wynosi dokładnie r. Kolejne liczby pierwsze
+ * dokładamy (paczkami, równolegle), aż ten warunek zajdzie lub r osiągnie liczbę
+ * niezerowych wierszy.
+ * 
+ * @return int Rząd macierzy
+ */
+int matrix::rzad() const {
+    std::vector<double> log2_normy; // log2 norm niezerowych wierszy
+    for (int i = 0; i < size; i++) {
+        double norma = 0.0;
+        for (int j = 0; j < size; j++) {
+            norma += static_cast<double>(data[i][j]) * data[i][j];
+        }
+        if (norma > 0.0) log2_normy.push_back(0.5 * std::log2(norma));
+    }
+    const int niezerowe = static_cast<int>(log2_normy.size());
+    std::sort(log2_normy.begin(), log2_normy.end(), std::greater<double>());
+    std::vector<double> log2_hadamard(niezerowe + 1, 0.0); // log2 H_k
+    for (int k = 0; k < niezerowe; k++) log2_hadamard[k + 1] = log2_hadamard[k] + log2_normy[k];
+
+    const int paczka = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int r = 0;
+    double bity = 0.0;
+    std::uint32_t p = granica_modulow;
+    while (r < niezerowe && bity <= log2_hadamard[r + 1] + 1.0) {
+        std::vector<std::uint32_t> moduly(paczka);
+        for (std::uint32_t& m : moduly) {
+            p = poprzednia_pierwsza(p);
+            m = p;
+            bity += std::log2(static_cast<double>(p));
+        }
+        std::vector<int> rzedy(paczka);
+        rownolegle(paczka, [&](int i) {
+            std::vector<std::uint32_t> a = spakuj_mod(data, size, size, static_cast<int>(moduly[i]));
+            rzedy[i] = eliminuj_mod(a, size, size, size, moduly[i], false, nullptr);
+        });
+        r = std::max(r, *std::max_element(rzedy.begin(), rzedy.end()));
+    }
+    return r;
+}
+
+/**
+ * @brief Odwraca macierz modulo liczba pierwsza p metodą Gaussa-Jordana.
+ * 
+ * @param p Moduł (liczba pierwsza)
+ * @return matrix& Odwołanie do obecnego obiektu macierzy
+ * @throws std::invalid_argument Jeśli p nie jest liczbą pierwszą
+ * @throws std::domain_error Jeśli macierz jest osobliwa modulo p
+ */
+matrix& matrix::odwrotna_mod(int p) {
+    sprawdz_pierwsza(p);
+    const int w = 2 * size;
+    std::vector<std::uint32_t> a = spakuj_mod(data, size, w, p);
+    for (int i = 0; i < size; i++) a[static_cast<std::size_t>(i) * w + size + i] = 1 % p;
+    if (eliminuj_mod(a, size, w, size, static_cast<std::uint32_t>(p), true, nullptr) < size) {
+        throw std::domain_error("Matrix is singular modulo p");
+    }
+    odlacz();
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            data[i][j] = static_cast<int>(a[static_cast<std::size_t>(i) * w + size + j]);
+        }
+    }
+    return *this;
+}
+
+/**
+ * @brief Rozwiązuje układ A x = b modulo liczba pierwsza p metodą Gaussa-Jordana.
+ * 
+ * @param b Prawe strony
+ * @param x Tablica na rozwiązanie (wartości z [0, p))
+ * @param p Moduł (liczba pierwsza)
+ * @throws std::invalid_argument Jeśli p nie jest liczbą pierwszą
+ * @throws std::domain_error Jeśli macierz jest osobliwa modulo p
+ */
+void matrix::rozwiaz_mod(const int* b, int* x, int p) const {
+    sprawdz_pierwsza(p);
+    const int w = size + 1;
+    std::vector<std::uint32_t> a = spakuj_mod(data, size, w, p);
+    for (int i = 0; i < size; i++) a[static_cast<std::size_t>(i) * w + size] = reszta(b[i], p);
+    if (eliminuj_mod(a, size, w, size, static_cast<std::uint32_t>(p), true, nullptr) < size) {
+        throw std::domain_error("Matrix is singular modulo p");
+    }
+    for (int i = 0; i < size; i++) x[i] = static_cast<int>(a[static_cast<std::size_t>(i) * w + size]);
+}
+
+/**
+ * @brief Rozwiązuje dokładnie układ A x = b (wzory Cramera odtwarzane wielomodularnie).
+ * 
+ * @param b Prawe strony
+ * @param x Tablica na liczniki rozwiązania
+ * @return long long Mianownik D = det(A); rozwiązaniem jest x[i] / D
+ * @throws std::domain_error Jeśli macierz jest osobliwa
+ * @throws std::overflow_error Jeśli D lub któryś z liczników nie mieści się w long long
+ */
+long long matrix::rozwiaz(const int* b, long long* x) const {
+    std::vector<duza_liczba> liczniki;
+    long long d = 0;
+    if (!rozwiaz_crt(data, size, b, 1, liczniki).do_long_long(d)) {
+        throw std::overflow_error("Determinant exceeds long long range");
+    }
+    for (int i = 0; i < size; i++) {
+        if (!liczniki[i].do_long_long(x[i])) {
+            throw std::overflow_error("Solution numerator exceeds long long range");
+        }
+    }
+    return d;
+}
+
+/**
+ * @brief Rozwiązuje dokładnie układ A x = b bez ograniczenia wielkości liczników i mianownika.
+ * 
+ * @param b Prawe strony
+ * @param x Tablica na zapisy dziesiętne liczników rozwiązania
+ * @return std::string Zapis dziesiętny mianownika D = det(A); rozwiązaniem jest x[i] / D
+ * @throws std::domain_error Jeśli macierz jest osobliwa
+ */
+std::string matrix::rozwiaz_dokladnie(const int* b, std::string* x) const {
+    std::vector<duza_liczba> liczniki;
+    const duza_liczba d = rozwiaz_crt(data, size, b, 1, liczniki);
+    for (int i = 0; i < size; i++) x[i] = liczniki[i].dziesietnie();
+    return d.dziesietnie();
+}
+
+/**
+ * @brief Oblicza dokładną odwrotność A^{-1} = adj(A) / det(A).
+ * 
+ * Macierz dołączona powstaje jako liczniki rozwiązania A X = I (kolumny jednostkowe
+ * jako prawe strony) tą samą metodą wielomodularną co rozwiaz_dokladnie().
+ * 
+ * @param x Tablica n * n na zapisy dziesiętne elementów adj(A) wierszami
+ * @return std::string Zapis dziesiętny mianownika D = det(A); A^{-1}[i][j] = x[i * n + j] / D
+ * @throws std::domain_error Jeśli macierz jest osobliwa
+ */
+std::string matrix::odwrotna_dokladna(std::string* x) const {
+    std::vector<duza_liczba> liczniki;
+    const duza_liczba d = rozwiaz_crt(data, size, nullptr, size, liczniki);
+    for (std::size_t i = 0; i < liczniki.size(); i++) x[i] = liczniki[i].dziesietnie();
+    return d.dziesietnie();
+}
+
+// Redukcje i statystyki
+//
+// Wiersze leżą w jednym ciągłym bloku, więc redukcje przechodzą po pamięci sekwencyjnie.
+// Wszystkie akumulatory są całkowitoliczbowe i dokładne, więc wynik nie zależy od
+// podziału na bloki ani liczby wątków.
+
+/**
+ * @brief Sumuje wszystkie elementy macierzy (równolegle po blokach wierszy).
+ * Wynik jest dokładny, dopóki mieści się w long long (np. dla n <= 65535 zawsze).
+ * 
+ * @return long long Suma elementów
+ */
+long long matrix::suma() const {
+    long long wynik = 0;
+    std::vector<long long> sumy(size);
+    sumy_wierszy(sumy.data());
+    for (int i = 0; i < size; i++) wynik += sumy[i];
+    return wynik;
+}
+
+/**
+ * @brief Oblicza ślad macierzy.
+ * 
+ * @return long long Suma elementów na przekątnej
+ */
+long long matrix::slad() const {
+    long long wynik = 0;
+    for (int i = 0; i < size; i++) wynik += data[i][i];
+    return wynik;
+}
+
+/**
+ * @brief Znajduje najmniejszy element macierzy i jego pierwsze wystąpienie (w kolejności wierszy).
+ * 
+ * @param x Wskaźnik na indeks wiersza (może być pusty)
+ * @param y Wskaźnik na indeks kolumny (może być pusty)
+ * @return int Najmniejszy element
+ * @throws std::length_error Jeśli macierz jest pusta
+ */
+int matrix::minimum(int* x, int* y) const {
+    return skrajny_element(data, size, std::less<int>(), x, y);
+}
+
+/**
+ * @brief Znajduje największy element macierzy i jego pierwsze wystąpienie (w kolejności wierszy).
+ * 
+ * @param x Wskaźnik na indeks wiersza (może być pusty)
+ * @param y Wskaźnik na indeks kolumny (może być pusty)
+ * @return int Największy element
+ * @throws std::length_error Jeśli macierz jest pusta
+ */
+int matrix::maksimum(int* x, int* y) const {
+    return skrajny_element(data, size, std::greater<int>(), x, y);
+}
+
+/**
+ * @brief Oblicza normę Frobeniusa.
+ * 
+ * Kwadraty elementów (< 2^62) sumowane są dokładnie w 128-bitowym akumulatorze
+ * złożonym z dwóch słów 64-bitowych; do double zamieniamy dopiero sumę końcową.
+ * 
+ * @return double Norma Frobeniusa
+ */
+double matrix::norma_frobeniusa() const {
+    const int bloki = bloki_wierszy(size);
+    std::vector<std::uint64_t> niskie(bloki), wysokie(bloki);
+    rownolegle(bloki, [&](int b) {
+        int poczatek, koniec;
+        zakres_bloku(size, bloki, b, poczatek, koniec);
+        std::uint64_t lo = 0, hi = 0;
+        for (int i = poczatek; i < koniec; i++) {
+            const int* w = data[i];
+            for (int j = 0; j < size; j++) {
+                const std::uint64_t kwadrat = static_cast<std::uint64_t>(static_cast<long long>(w[j]) * w[j]);
+                lo += kwadrat;
+                hi += lo < kwadrat; // Przeniesienie
+            }
+        }
+        niskie[b] = lo;
+        wysokie[b] = hi;
+    });
+    std::uint64_t lo = 0, hi = 0;
+    for (int b = 0; b < bloki; b++) {
+        lo += niskie[b];
+        hi += wysokie[b] + (lo < niskie[b]);
+    }
+    return std::sqrt(std::ldexp(static_cast<double>(hi), 64) + static_cast<double>(lo));
+}
+
+/**
+ * @brief Oblicza sumy elementów w każdym wierszu (równolegle po blokach wierszy).
+ * 
+ * @param wynik Tablica na n sum wierszy
+ */
+void matrix::sumy_wierszy(long long* wynik) const {
+    const int bloki = bloki_wierszy(size);
+    rownolegle(bloki, [&](int b) {
+        int poczatek, koniec;
+        zakres_bloku(size, bloki, b, poczatek, koniec);
+        for (int i = poczatek; i < koniec; i++) {
+            const int* w = data[i];
+            long long s = 0;
+            for (int j = 0; j < size; j++) s += w[j];
+            wynik[i] = s;
+        }
+    });
+}
+
+/**
+ * @brief Oblicza sumy elementów w każdej kolumnie.
+ * 
+ * Zamiast przechodzić po kolumnach z krokiem n, każdy blok wierszy dodaje swoje wiersze
+ * do własnego wektora sum częściowych (dostęp sekwencyjny, wektoryzowany). Sumy
+ * częściowe bloków są na końcu dodawane w stałej kolejności.
+ * 
+ * @param wynik Tablica na n sum kolumn
+ */
+void matrix::sumy_kolumn(long long* wynik) const {
+    const int bloki = bloki_wierszy(size);
+    const std::size_t n = static_cast<std::size_t>(size);
+    std::vector<long long> czesciowe(bloki * n, 0);
+    rownolegle(bloki, [&](int b) {
+        int poczatek, koniec;
+        zakres_bloku(size, bloki, b, poczatek, koniec);
+        long long* acc = &czesciowe[b * n];
+        for (int i = poczatek; i < koniec; i++) {
+            const int* w = data[i];
+            for (std::size_t j = 0; j < n; j++) acc[j] += w[j];
+        }
+    });
+    for (std::size_t j = 0; j < n; j++) wynik[j] = 0;
+    for (int b = 0; b < bloki; b++) {
+        const long long* acc = &czesciowe[b * n];
+        for (std::size_t j = 0; j < n; j++) wynik[j] += acc[j];
+    }
+}
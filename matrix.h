@@ -13,6 +13,8 @@
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
+#include <atomic>
+#include <string>
 
 /**
  * @class matrix
@@ -23,7 +25,17 @@
  */
 class matrix {
 private:
-    int** data; /**< Wskaźnik do przechowywania macierzy */
+    /**
+     * @brief Bufor elementów współdzielony przez kopie macierzy (copy-on-write).
+     */
+    struct bufor {
+        std::atomic<int> licznik; /**< Liczba macierzy korzystających z bufora */
+        int* elementy;            /**< Ciągły blok n * n elementów */
+        int** wiersze;            /**< Wskaźniki na początki wierszy w bloku */
+    };
+
+    bufor* buf; /**< Współdzielony bufor z danymi */
+    int** data; /**< Wskaźnik do przechowywania macierzy (wiersze bufora) */
     int size;   /**< Rozmiar macierzy (n x n) */
 
     /**
@@ -37,6 +49,12 @@ private:
      */
     void deallocateMemory();
 
+    /**
+     * @brief Zapewnia wyłączną własność bufora przed modyfikacją.
+     * Jeśli bufor jest współdzielony, kopiuje elementy do nowego bufora.
+     */
+    void odlacz();
+
 public:
     /**
      * @brief Konstruktor domyślny.
@@ -61,7 +79,8 @@ public:
 
     /**
      * @brief Konstruktor kopiujący.
-     * Tworzy nową macierz na podstawie innej macierzy.
+     * Tworzy nową macierz na podstawie innej macierzy. Kopia współdzieli bufor
+     * z oryginałem aż do pierwszej modyfikacji którejkolwiek z nich.
      * @param m Obiekt macierzy, z którego kopiujemy dane.
      */
     matrix(const matrix& m);
@@ -97,8 +116,15 @@ public:
     int pokaz(int x, int y) const;
 
     /**
-     * @brief Odwraca macierz.
-     * @return Referencja do odwróconej macierzy.
+     * @brief Zwraca rozmiar macierzy.
+     * @return Liczba wierszy (i kolumn) macierzy.
+     */
+    int rozmiar() const;
+
+    /**
+     * @brief Transponuje macierz (zamienia wiersze z kolumnami).
+     * Odwrotność macierzy liczy odwrotna_dokladna() (nad liczbami wymiernymi) lub odwrotna_mod() (modulo p).
+     * @return Referencja do transponowanej macierzy.
      */
     matrix& dowroc();
 
@@ -170,6 +196,157 @@ public:
      */
     matrix& szachownica();
 
+    /**
+     * @brief Redukuje wszystkie elementy macierzy modulo p do zakresu [0, p).
+     * @param p Moduł (liczba dodatnia).
+     * @return Referencja do obiektu macierzy.
+     */
+    matrix& modulo(int p);
+
+    /**
+     * @brief Dodaje macierz m modulo p.
+     * @param m Druga macierz.
+     * @param p Moduł (liczba dodatnia).
+     * @return Referencja do obiektu wynikowej macierzy.
+     */
+    matrix& dodaj_mod(const matrix& m, int p);
+
+    /**
+     * @brief Mnoży macierz przez macierz m modulo p.
+     * Iloczyny są sumowane w akumulatorach 64-bitowych i redukowane (Barrett)
+     * dopiero przed przepełnieniem, więc wynik nie przepełnia się dla dowolnego n.
+     * @param m Druga macierz.
+     * @param p Moduł (liczba dodatnia).
+     * @return Referencja do obiektu wynikowej macierzy.
+     */
+    matrix& mnoz_mod(const matrix& m, int p);
+
+    /**
+     * @brief Podnosi macierz do potęgi k (potęgowanie przez podnoszenie do kwadratu).
+     * @param k Wykładnik (nieujemny).
+     * @return Referencja do obiektu macierzy.
+     */
+    matrix& potega(int k);
+
+    /**
+     * @brief Podnosi macierz do potęgi k modulo p (potęgowanie przez podnoszenie do kwadratu).
+     * @param k Wykładnik (nieujemny).
+     * @param p Moduł (liczba dodatnia).
+     * @return Referencja do obiektu macierzy.
+     */
+    matrix& potega_mod(long long k, int p);
+
+    /**
+     * @brief Oblicza wyznacznik macierzy modulo liczba pierwsza p.
+     * @param p Moduł (liczba pierwsza).
+     * @return Wyznacznik modulo p, z zakresu [0, p).
+     */
+    int wyznacznik_mod(int p) const;
+
+    /**
+     * @brief Oblicza dokładny wyznacznik macierzy (metoda wielomodularna z CRT).
+     * @return Wyznacznik macierzy.
+     */
+    long long wyznacznik() const;
+
+    /**
+     * @brief Oblicza dokładny wyznacznik macierzy dowolnej wielkości.
+     * @return Zapis dziesiętny wyznacznika.
+     */
+    std::string wyznacznik_dokladny() const;
+
+    /**
+     * @brief Oblicza dokładny rząd macierzy nad liczbami wymiernymi.
+     * @return Rząd macierzy.
+     */
+    int rzad() const;
+
+    /**
+     * @brief Odwraca macierz modulo liczba pierwsza p.
+     * @param p Moduł (liczba pierwsza).
+     * @return Referencja do odwróconej macierzy.
+     */
+    matrix& odwrotna_mod(int p);
+
+    /**
+     * @brief Rozwiązuje układ A x = b modulo liczba pierwsza p.
+     * @param b Tablica prawych stron (n elementów).
+     * @param x Tablica na rozwiązanie (n elementów).
+     * @param p Moduł (liczba pierwsza).
+     */
+    void rozwiaz_mod(const int* b, int* x, int p) const;
+
+    /**
+     * @brief Rozwiązuje dokładnie układ A x = b nad liczbami wymiernymi.
+     * Rozwiązaniem jest x[i] / D, gdzie D to zwracany wyznacznik macierzy.
+     * @param b Tablica prawych stron (n elementów).
+     * @param x Tablica na liczniki rozwiązania (n elementów).
+     * @return Wspólny mianownik D (wyznacznik macierzy).
+     */
+    long long rozwiaz(const int* b, long long* x) const;
+
+    /**
+     * @brief Rozwiązuje dokładnie układ A x = b nad liczbami wymiernymi, bez ograniczenia wielkości wyniku.
+     * Rozwiązaniem jest x[i] / D, gdzie D to zwracany wyznacznik macierzy.
+     * @param b Tablica prawych stron (n elementów).
+     * @param x Tablica na zapisy dziesiętne liczników rozwiązania (n elementów).
+     * @return Zapis dziesiętny wspólnego mianownika D (wyznacznika macierzy).
+     */
+    std::string rozwiaz_dokladnie(const int* b, std::string* x) const;
+
+    /**
+     * @brief Oblicza dokładną odwrotność macierzy jako adj(A) / det(A).
+     * @param x Tablica na zapisy dziesiętne elementów macierzy dołączonej, wierszami (n * n elementów).
+     * @return Zapis dziesiętny wspólnego mianownika D (wyznacznika macierzy).
+     */
+    std::string odwrotna_dokladna(std::string* x) const;
+
+    /**
+     * @brief Sumuje wszystkie elementy macierzy.
+     * @return Suma elementów.
+     */
+    long long suma() const;
+
+    /**
+     * @brief Oblicza ślad macierzy (sumę elementów na przekątnej).
+     * @return Ślad macierzy.
+     */
+    long long slad() const;
+
+    /**
+     * @brief Znajduje najmniejszy element macierzy.
+     * @param x Jeśli niepusty, otrzymuje indeks wiersza pierwszego wystąpienia.
+     * @param y Jeśli niepusty, otrzymuje indeks kolumny pierwszego wystąpienia.
+     * @return Najmniejszy element.
+     */
+    int minimum(int* x = nullptr, int* y = nullptr) const;
+
+    /**
+     * @brief Znajduje największy element macierzy.
+     * @param x Jeśli niepusty, otrzymuje indeks wiersza pierwszego wystąpienia.
+     * @param y Jeśli niepusty, otrzymuje indeks kolumny pierwszego wystąpienia.
+     * @return Największy element.
+     */
+    int maksimum(int* x = nullptr, int* y = nullptr) const;
+
+    /**
+     * @brief Oblicza normę Frobeniusa (pierwiastek z sumy kwadratów elementów).
+     * @return Norma Frobeniusa.
+     */
+    double norma_frobeniusa() const;
+
+    /**
+     * @brief Oblicza sumy elementów w każdym wierszu.
+     * @param wynik Tablica na n sum wierszy.
+     */
+    void sumy_wierszy(long long* wynik) const;
+
+    /**
+     * @brief Oblicza sumy elementów w każdej kolumnie.
+     * @param wynik Tablica na n sum kolumn.
+     */
+    void sumy_kolumn(long long* wynik) const;
+
     /**
      * @brief Operator dodawania dwóch macierzy.
      * @param m Druga macierz.